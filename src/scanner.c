@@ -1,3 +1,4 @@
+#include "tree_sitter/alloc.h"
 #include "tree_sitter/parser.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -32,12 +33,12 @@ static bool is_space(int32_t c) {
 }
 
 void *tree_sitter_procfile_external_scanner_create(void) {
-  Scanner *scanner = calloc(1, sizeof(Scanner));
+  Scanner *scanner = ts_calloc(1, sizeof(Scanner));
   return scanner;
 }
 
 void tree_sitter_procfile_external_scanner_destroy(void *payload) {
-  free(payload);
+  ts_free(payload);
 }
 
 unsigned tree_sitter_procfile_external_scanner_serialize(void *payload, char *buffer) {
@@ -189,9 +190,10 @@ static bool scan_multiline_command_text(TSLexer *lexer) {
   return false;
 }
 
+// '.' allows namespaced keys such as cpu.max= and memory.max=
 static bool is_option_key_char(int32_t c) {
   return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
-         (c >= '0' && c <= '9') || c == '_';
+         (c >= '0' && c <= '9') || c == '_' || c == '.';
 }
 
 static bool is_option_key_start(int32_t c) {